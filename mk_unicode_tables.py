@@ -0,0 +1,206 @@
+#!/usr/bin/env python3
+#
+# mk_unicode_tables.py generates UnicodeTables.Mod, the data behind
+# Unicode.Mod.
+#
+# Usage: ./mk_unicode_tables.py [UnicodeData.txt [VERSION]] > UnicodeTables.Mod
+#
+# With a UnicodeData.txt from https://www.unicode.org/Public/ the tables
+# are built from it, otherwise from the Unicode database bundled with
+# Python. Each codepoint gets a property: general category, simple
+# upper and lower case mapping (as deltas) and decimal digit value.
+# The distinct properties are numbered and the codepoints are split
+# into blocks of BLOCK_SIZE; identical blocks are stored once. The
+# property list, the block of each stretch of codepoints and the
+# property of each codepoint within the stored blocks are written as
+# run lengths in a compact printable varint encoding that Unicode.Mod
+# decodes when it loads.
+#
+import sys
+
+# Must match the category constants of Unicode.Mod
+CATEGORIES = [
+    'Cn', 'Lu', 'Ll', 'Lt', 'Lm', 'Lo', 'Mn', 'Mc', 'Me', 'Nd',
+    'Nl', 'No', 'Pc', 'Pd', 'Ps', 'Pe', 'Pi', 'Pf', 'Po', 'Sm',
+    'Sc', 'Sk', 'So', 'Zs', 'Zl', 'Zp', 'Cc', 'Cf', 'Cs', 'Co'
+]
+CODEPOINTS = 0x110000
+BLOCK_SIZE = 256
+LINE_WIDTH = 64
+LINES_PER_PROCEDURE = 100
+
+#
+# read_unicode_data returns category, upper, lower and digit lists
+# indexed by codepoint from a UnicodeData.txt file.
+#
+def read_unicode_data(filename):
+    category = ['Cn'] * CODEPOINTS
+    upper = list(range(CODEPOINTS))
+    lower = list(range(CODEPOINTS))
+    digit = [-1] * CODEPOINTS
+    first = None
+    with open(filename, encoding = 'utf-8') as f:
+        for line in f:
+            fields = line.strip().split(';')
+            if len(fields) < 15:
+                continue
+            cp = int(fields[0], 16)
+            if fields[1].endswith(', First>'):
+                first = cp
+                continue
+            start = first if fields[1].endswith(', Last>') else cp
+            first = None
+            for c in range(start, cp + 1):
+                category[c] = fields[2]
+                if fields[2] == 'Nd':
+                    digit[c] = int(fields[6])
+                if fields[12] != '':
+                    upper[c] = int(fields[12], 16)
+                if fields[13] != '':
+                    lower[c] = int(fields[13], 16)
+    return category, upper, lower, digit
+
+#
+# read_python_data returns the same lists from Python's own database.
+# Python exposes full case mappings, the simple ones are recovered
+# from them: a single character upper or title case, and the lower
+# case of U+0130, the only simple lower mapping with a longer full one.
+#
+def read_python_data():
+    import unicodedata
+    category = [unicodedata.category(chr(c)) for c in range(CODEPOINTS)]
+    upper = list(range(CODEPOINTS))
+    lower = list(range(CODEPOINTS))
+    digit = [-1] * CODEPOINTS
+    for c in range(CODEPOINTS):
+        s = chr(c)
+        if category[c] == 'Nd':
+            digit[c] = unicodedata.decimal(s)
+        for t in (s.upper(), s.title()):
+            if len(t) == 1:
+                upper[c] = ord(t)
+                break
+        t = s.lower()
+        if len(t) == 1:
+            lower[c] = ord(t)
+    lower[0x130] = 0x69
+    return category, upper, lower, digit
+
+def zigzag(n):
+    return 2 * n if n >= 0 else -2 * n - 1
+
+#
+# varint encodes a non-negative number as base 32 digits, least
+# significant first, each written as chr(ord('0') + d) with 32 added
+# to every digit but the last.
+#
+def varint(n):
+    out = []
+    while n >= 32:
+        out.append(chr(ord('0') + 32 + n % 32))
+        n //= 32
+    out.append(chr(ord('0') + n))
+    return ''.join(out)
+
+def runs(values):
+    out = []
+    i = 0
+    while i < len(values):
+        j = i
+        while j < len(values) and values[j] == values[i]:
+            j += 1
+        out.append(varint(j - i) + varint(values[i]))
+        i = j
+    return out
+
+def main(args):
+    if len(args) > 0:
+        category, upper, lower, digit = read_unicode_data(args[0])
+        version = args[1] if len(args) > 1 else 'unknown'
+    else:
+        import unicodedata
+        category, upper, lower, digit = read_python_data()
+        version = unicodedata.unidata_version
+
+    properties = {}
+    codes = []
+    for c in range(CODEPOINTS):
+        p = (CATEGORIES.index(category[c]), upper[c] - c, lower[c] - c, digit[c])
+        codes.append(properties.setdefault(p, len(properties)))
+    blocks = {}
+    stage1 = []
+    for b in range(0, CODEPOINTS, BLOCK_SIZE):
+        stage1.append(blocks.setdefault(tuple(codes[b:b + BLOCK_SIZE]), len(blocks)))
+    stage2 = [p for block in sorted(blocks, key = blocks.get) for p in block]
+    assert len(properties) <= 256 and len(blocks) <= 256, 'tables no longer fit in BYTE'
+
+    items = []
+    for (cat, up, low, dig) in sorted(properties, key = properties.get):
+        items.append(varint(cat) + varint(zigzag(up)) + varint(zigzag(low)) + varint(dig + 1))
+    items.extend(runs(stage1))
+    items.extend(runs(stage2))
+    lines = []
+    line = ''
+    for item in items:
+        if len(line) + len(item) > LINE_WIDTH:
+            lines.append(line)
+            line = ''
+        line += item
+    lines.append(line)
+    size = sum(len(l) for l in lines)
+
+    out = []
+    out.append('''(**
+    UnicodeTables.Mod - Unicode {version} character data for Unicode.Mod.
+
+    Generated by mk_unicode_tables.py, do not edit. Regenerate with
+    make unicode_tables.
+
+    Copyright (C) 2025
+    Released under The 3-Clause BSD License.
+*)
+MODULE UnicodeTables;
+
+CONST
+    Version* = "{version}";
+    BlockSize* = {block_size};
+    Blocks* = {blocks};
+    Properties* = {properties};
+    Size* = {size};
+
+VAR
+    (** Encoded tables, see mk_unicode_tables.py *)
+    data*: ARRAY Size OF CHAR;
+    length: INTEGER;
+
+PROCEDURE Add(s: ARRAY OF CHAR);
+VAR i: INTEGER;
+BEGIN
+    i := 0;
+    WHILE (i < LEN(s)) & (s[i] # 0X) DO
+        data[length] := s[i];
+        INC(length); INC(i)
+    END
+END Add;
+'''.format(version = version, block_size = BLOCK_SIZE, blocks = len(blocks),
+           properties = len(properties), size = size))
+    procedures = []
+    for k in range(0, len(lines), LINES_PER_PROCEDURE):
+        name = 'Load{}'.format(len(procedures))
+        procedures.append(name)
+        out.append('PROCEDURE {};'.format(name))
+        out.append('BEGIN')
+        chunk = lines[k:k + LINES_PER_PROCEDURE]
+        for i, l in enumerate(chunk):
+            out.append('    Add("{}"){}'.format(l, ';' if i < len(chunk) - 1 else ''))
+        out.append('END {};'.format(name))
+        out.append('')
+    out.append('BEGIN')
+    out.append('    length := 0;')
+    for i, name in enumerate(procedures):
+        out.append('    {}{}'.format(name, ';' if i < len(procedures) - 1 else ''))
+    out.append('END UnicodeTables.')
+    print('\n'.join(out))
+
+if __name__ == '__main__':
+    main(sys.argv[1:])
@@ -0,0 +1,165 @@
+/*GENERATED BY OBNC 0.17.2*/
+
+#include "artSwar.h"
+#include <obnc/OBNC.h>
+#include <stdint.h>
+#include <string.h>
+
+#define OBERON_SOURCE_FILENAME "artSwar.obn"
+
+/* Every byte 0x01, every byte 0x80 */
+#define ONES UINT64_C(0x0101010101010101)
+#define HIGHS UINT64_C(0x8080808080808080)
+
+/* Nonzero exactly when some byte of w is zero */
+#define HAS_ZERO(w) (((w) - ONES) & ~(w) & HIGHS)
+
+/* Unaligned word access; compilers turn the memcpy into one move */
+static uint64_t Load(const char *p)
+{
+	uint64_t w;
+
+	memcpy(&w, p, sizeof w);
+	return w;
+}
+
+static void Store(char *p, uint64_t w)
+{
+	memcpy(p, &w, sizeof w);
+}
+
+/* Sets table[c] for each c in cutset up to its 0X */
+static void CutTable(const char cutset_[], OBNC_INTEGER cutset_len, unsigned char table[256])
+{
+	OBNC_INTEGER i;
+
+	memset(table, 0, 256);
+	for (i = 0; (i < cutset_len) && (cutset_[i] != '\0'); i++) {
+		table[(unsigned char) cutset_[i]] = 1;
+	}
+}
+
+OBNC_INTEGER artSwar__Length_(const char source_[], OBNC_INTEGER source_len)
+{
+	OBNC_INTEGER i = 0;
+
+	while ((i + 8 <= source_len) && ! HAS_ZERO(Load(source_ + i))) {
+		i += 8;
+	}
+	while ((i < source_len) && (source_[i] != '\0')) {
+		i++;
+	}
+	return i;
+}
+
+int artSwar__Equal_(const char a_[], OBNC_INTEGER a_len, const char b_[], OBNC_INTEGER b_len)
+{
+	OBNC_INTEGER i = 0, n;
+	uint64_t w;
+	char ca, cb;
+
+	n = (a_len < b_len) ? a_len : b_len;
+	/* Whole words while they match and hold no 0X */
+	while (i + 8 <= n) {
+		w = Load(a_ + i);
+		if ((w != Load(b_ + i)) || HAS_ZERO(w)) {
+			break;
+		}
+		i += 8;
+	}
+	while ((i < n) && (a_[i] == b_[i]) && (a_[i] != '\0')) {
+		i++;
+	}
+	ca = (i < a_len) ? a_[i] : '\0';
+	cb = (i < b_len) ? b_[i] : '\0';
+	return (ca == '\0') && (cb == '\0');
+}
+
+OBNC_INTEGER artSwar__IndexOf_(char c_, const char source_[], OBNC_INTEGER source_len, OBNC_INTEGER pos_)
+{
+	OBNC_INTEGER i, result = -1;
+	uint64_t w, pattern;
+
+	if (c_ != '\0') {
+		i = (pos_ < 0) ? 0 : pos_;
+		pattern = ONES * (unsigned char) c_;
+		/* Skip words holding neither c nor 0X */
+		while (i + 8 <= source_len) {
+			w = Load(source_ + i);
+			if (HAS_ZERO(w) || HAS_ZERO(w ^ pattern)) {
+				break;
+			}
+			i += 8;
+		}
+		while ((i < source_len) && (source_[i] != '\0') && (source_[i] != c_)) {
+			i++;
+		}
+		if ((i < source_len) && (source_[i] == c_)) {
+			result = i;
+		}
+	}
+	return result;
+}
+
+void artSwar__Cap_(char source_[], OBNC_INTEGER source_len)
+{
+	OBNC_INTEGER i = 0;
+	uint64_t w, low, lower;
+
+	while (i + 8 <= source_len) {
+		w = Load(source_ + i);
+		if (HAS_ZERO(w)) {
+			break;
+		}
+		/* The high bit of a byte in lower is set if it is "a" to "z":
+		   adding to the low seven bits never carries into the next
+		   byte, and ~w drops bytes of 80X and above. */
+		low = w & ~HIGHS;
+		lower = ((low + ONES * (0x80 - 'a')) ^ (low + ONES * (0x80 - 'z' - 1))) & ~w & HIGHS;
+		if (lower != 0) {
+			Store(source_ + i, w ^ (lower >> 2));
+		}
+		i += 8;
+	}
+	while ((i < source_len) && (source_[i] != '\0')) {
+		if ((source_[i] >= 'a') && (source_[i] <= 'z')) {
+			source_[i] = (char) (source_[i] - ('a' - 'A'));
+		}
+		i++;
+	}
+}
+
+void artSwar__TrimLeft_(const char cutset_[], OBNC_INTEGER cutset_len, char source_[], OBNC_INTEGER source_len)
+{
+	unsigned char table[256];
+	OBNC_INTEGER i = 0, n;
+
+	CutTable(cutset_, cutset_len, table);
+	n = artSwar__Length_(source_, source_len);
+	while ((i < n) && table[(unsigned char) source_[i]]) {
+		i++;
+	}
+	if (i > 0) {
+		memmove(source_, source_ + i, (size_t) (n - i));
+		source_[n - i] = '\0';
+	}
+}
+
+void artSwar__TrimRight_(const char cutset_[], OBNC_INTEGER cutset_len, char source_[], OBNC_INTEGER source_len)
+{
+	unsigned char table[256];
+	OBNC_INTEGER i;
+
+	CutTable(cutset_, cutset_len, table);
+	i = artSwar__Length_(source_, source_len);
+	while ((i > 0) && table[(unsigned char) source_[i - 1]]) {
+		i--;
+	}
+	if (i < source_len) {
+		source_[i] = '\0';
+	}
+}
+
+void artSwar__Init(void)
+{
+}
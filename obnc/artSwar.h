@@ -0,0 +1,29 @@
+/*GENERATED BY OBNC 0.17.2*/
+
+#ifndef artSwar_h
+#define artSwar_h
+
+#include <obnc/OBNC.h>
+
+#define artSwar__Length_ obnc__artSwar__Length_
+OBNC_INTEGER artSwar__Length_(const char source_[], OBNC_INTEGER source_len);
+
+#define artSwar__Equal_ obnc__artSwar__Equal_
+int artSwar__Equal_(const char a_[], OBNC_INTEGER a_len, const char b_[], OBNC_INTEGER b_len);
+
+#define artSwar__IndexOf_ obnc__artSwar__IndexOf_
+OBNC_INTEGER artSwar__IndexOf_(char c_, const char source_[], OBNC_INTEGER source_len, OBNC_INTEGER pos_);
+
+#define artSwar__Cap_ obnc__artSwar__Cap_
+void artSwar__Cap_(char source_[], OBNC_INTEGER source_len);
+
+#define artSwar__TrimLeft_ obnc__artSwar__TrimLeft_
+void artSwar__TrimLeft_(const char cutset_[], OBNC_INTEGER cutset_len, char source_[], OBNC_INTEGER source_len);
+
+#define artSwar__TrimRight_ obnc__artSwar__TrimRight_
+void artSwar__TrimRight_(const char cutset_[], OBNC_INTEGER cutset_len, char source_[], OBNC_INTEGER source_len);
+
+#define artSwar__Init obnc__artSwar__Init
+void artSwar__Init(void);
+
+#endif